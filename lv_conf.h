@@ -96,6 +96,19 @@
  * (Not so important, you can adjust it to modify default sizes and spaces.) */
 #define LV_DPI_DEF 130              /**< [px/inch] */
 
+/** Number of frames whose redrawn areas are remembered for buffer-age based damage tracking.
+ * In `LV_DISPLAY_RENDER_MODE_DIRECT` with 2 or 3 buffers the areas a buffer missed since it was last
+ * rendered are re-rendered into it instead of being copied from the other buffer.
+ * Buffers older than this number of frames are fully redrawn.
+ * 0: Disable damage tracking and keep the buffers in sync by copying the areas. */
+#define LV_DISPLAY_DAMAGE_HISTORY_CNT 3
+
+/** 1: When a widget is scrolled in `LV_DISPLAY_RENDER_MODE_DIRECT`, move the already rendered pixels
+ * of its content in the draw buffer and redraw only the uncovered areas and the widgets above them.
+ * Used only if the scrolled widget has an opaque, solid background and it's not transformed or
+ * semi-transparent. Else the widget is fully redrawn as usual. */
+#define LV_DISPLAY_SCROLL_BLIT 1
+
 /*=================
  * OPERATING SYSTEM
  *=================*/
@@ -153,6 +166,18 @@
  * Set it to 0 to have no limit. */
 #define LV_DRAW_LAYER_MAX_MEMORY 0  /**< No limit by default [bytes]*/
 
+/** Keep the buffers of the freed layers in a pool and reuse them for the next layers
+ * instead of allocating new buffers for each chunk and frame. The buffers are allocated in size classes,
+ * so a buffer can be reused for a slightly larger layer too.
+ * The pool is emptied if allocating a layer buffer fails.
+ * Set it to 0 to free the layer buffers right away. */
+#define LV_DRAW_LAYER_POOL_SIZE (64 * 1024)  /**< [bytes]*/
+
+/** Drop the queued draw tasks of a layer which are covered by a later opaque fill and
+ * reduce the clip area of the partially covered ones. The tasks are drawn only when a layer is blended
+ * or all the tasks of the area are added, so more draw tasks are kept in memory at the same time. */
+#define LV_DRAW_OCCLUSION_CULLING 1
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -213,11 +238,18 @@
          *  `shadow_width + radius`.  Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost. */
         #define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
 
-        /** Set number of maximally-cached circle data.
-         *  The circumference of 1/4 circle are saved for anti-aliasing.
-         *  `radius * 4` bytes are used per circle (the most often used radiuses are saved).
+        /** Size of the circle cache in bytes.
+         *  The circumference of 1/4 circle are saved for anti-aliasing of rounded corners,
+         *  `radius * 6` bytes per circle. The cache is kept between frames and the least
+         *  recently used circles are dropped when the size is exceeded.
          *  - 0: disables caching */
-        #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
+        #define LV_DRAW_SW_CIRCLE_CACHE_MEM_SIZE (16 * 1024)
+
+        /** Calculate the anti-aliasing of arcs and rounded corners analytically from the
+         *  distance of the pixels to the edge of the circle, instead of combining
+         *  precalculated circle and angle masks. Faster for large radii and needs no circle cache.
+         *  The edges might differ slightly from the default rendering. */
+        #define LV_DRAW_SW_ANALYTIC_AA 1
     #endif
 
     #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
@@ -457,15 +489,35 @@
 
 /** Default cache size in bytes.
  *  Used by image decoders such as `lv_lodepng` to keep the decoded image in memory.
- *  If size is not set to 0, the decoder will fail to decode when the cache is full.
+ *  The size is a soft limit: if the images in use don't fit, the cache grows over it
+ *  instead of failing to decode, and shrinks back as the images are released.
+ *  The images used only once are evicted before the frequently used ones.
  *  If size is 0, the cache function is not enabled and the decoded memory will be
  *  released immediately after use. */
-#define LV_CACHE_DEF_SIZE       0
+#define LV_CACHE_DEF_SIZE       (128 * 1024)
 
 /** Default number of image header cache entries. The cache is used to store the headers of images
  *  The main logic is like `LV_CACHE_DEF_SIZE` but for image headers. */
 #define LV_IMAGE_HEADER_CACHE_DEF_CNT 0
 
+/** Number of image sources whose image cache hits, misses and evictions are counted.
+ *  See `lv_image_cache_get_src_stats()`. 0: count only the totals. */
+#define LV_IMAGE_CACHE_SRC_STATS_CNT 0
+
+/** 1: Enable `lv_image_prefetch()` to decode images into the image cache in background threads.
+ *  Requires `LV_USE_OS` and a non-zero `LV_CACHE_DEF_SIZE`. */
+#define LV_USE_IMAGE_PREFETCH 0
+#if LV_USE_IMAGE_PREFETCH
+    /** Number of threads decoding the images in parallel. */
+    #define LV_IMAGE_PREFETCH_THREAD_CNT 2
+
+    /** Priority of the threads. They should run only when the UI is idle. */
+    #define LV_IMAGE_PREFETCH_THREAD_PRIO LV_THREAD_PRIO_LOW
+
+    /** Stack size of the threads. The decoders need a few kB of stack. */
+    #define LV_IMAGE_PREFETCH_THREAD_STACK_SIZE (8 * 1024)
+#endif
+
 /** Number of stops allowed per gradient. Increase this to allow more stops.
  *  This adds (sizeof(lv_color_t) + 1) bytes per additional stop. */
 #define LV_GRADIENT_MAX_STOPS   4
@@ -481,6 +533,21 @@
 /** Add 2 x 32-bit variables to each `lv_obj_t` to speed up getting style properties */
 #define LV_OBJ_STYLE_CACHE      1
 
+/** Store the resolved style properties of each drawn part of the widgets (~200 bytes per part)
+ *  to initialize the draw descriptors without looking up the styles again.
+ *  They are resolved again only if a style property or the state of the widget changes. */
+#define LV_OBJ_STYLE_SNAPSHOT   1
+
+/** Keep a bitmask of the event codes having callbacks in each event list (16 bytes per list)
+ *  to skip the lists without callbacks for the sent event code (e.g. when drawing). */
+#define LV_EVENT_FILTER_MASK    1
+
+/** Build a grid of the children of widgets having at least this many children (e.g. lists)
+ *  to check only the children around the point when searching the pressed widget.
+ *  The grid is built again only if a child is added, moved, resized or hidden.
+ *  0: disable */
+#define LV_OBJ_HIT_INDEX_MIN_CHILDREN  32
+
 /** Add `id` field to `lv_obj_t` */
 #define LV_USE_OBJ_ID           0
 
@@ -646,6 +713,17 @@
 /** Enables/disables support for compressed fonts. */
 #define LV_USE_FONT_COMPRESSED 0
 
+/** Size of the cache for the rendered glyphs of built-in (`lv_font_fmt_txt`) fonts in bytes.
+ *  Glyphs are unpacked or decompressed to A8 only once and drawn from the cache while they fit.
+ *  0: disables caching */
+#define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE (32 * 1024)
+
+/** Create hash tables for the glyph ids and kerning pairs of built-in (`lv_font_fmt_txt`) fonts
+ *  to find them in constant time instead of searching the character maps for each letter.
+ *  The tables are created at the first use of a font and need ~0.5 kB plus ~16 bytes
+ *  per letter above U+00FF and per kerning pair. */
+#define LV_FONT_FMT_TXT_FAST_LOOKUP 1
+
 /** Enable drawing placeholders when glyph dsc is not found. */
 #define LV_USE_FONT_PLACEHOLDER 1
 
@@ -755,6 +833,7 @@
 #if LV_USE_LABEL
     #define LV_LABEL_TEXT_SELECTION 1   /**< Enable selecting text of the label */
     #define LV_LABEL_LONG_TXT_HINT 1    /**< Store some extra info in labels to speed up drawing of very long text */
+    #define LV_LABEL_LAYOUT_CACHE 1    /**< Store the line breaks and size of the text to not measure it again when redrawn or set to the same text */
     #define LV_LABEL_WAIT_CHAR_COUNT 3  /**< The count of wait chart */
 #endif
 
@@ -838,6 +917,11 @@
 /** A layout similar to Grid in CSS. */
 #define LV_USE_GRID 1
 
+/** Update the layouts incrementally: skip the subtrees without layout changes and keep
+ *  the layout related style properties of the children (e.g. margins, flex grow, grid cell)
+ *  until a style changes, instead of reading them on every layout update. */
+#define LV_LAYOUT_INCREMENTAL 1
+
 /*====================
  * 3RD PARTS LIBRARIES
  *====================*/
@@ -850,6 +934,16 @@
  *  https://docs.lvgl.io/master/details/main-modules/fs.html#lv-fs-identifier-letters . */
 #define LV_FS_DEFAULT_DRIVER_LETTER '\0'
 
+/** 1: Cache the data read by `lv_fs_read()` in pages shared by all the files.
+ *  Used for the files opened for reading on the drivers without their own cache (`*_CACHE_SIZE 0`). */
+#define LV_USE_FS_BLOCK_CACHE 0
+#if LV_USE_FS_BLOCK_CACHE
+    #define LV_FS_BLOCK_CACHE_PAGE_SIZE 4096    /**< Size of a page in bytes */
+    #define LV_FS_BLOCK_CACHE_PAGE_CNT 16       /**< Number of pages. The least recently used page is reused. */
+    #define LV_FS_BLOCK_CACHE_READ_AHEAD 4      /**< Number of pages to read ahead when a file is read sequentially */
+    #define LV_FS_BLOCK_CACHE_PREFETCH_THREAD 0 /**< 1: Read ahead in a background thread. Requires `LV_USE_OS`. */
+#endif
+
 /** API for fopen, fread, etc. */
 #define LV_USE_FS_STDIO 1
 #if LV_USE_FS_STDIO
@@ -864,6 +958,7 @@
     #define LV_FS_POSIX_LETTER '\0'     /**< Set an upper-case driver-identifier letter for this driver (e.g. 'A'). */
     #define LV_FS_POSIX_PATH ""         /**< Set the working directory. File/directory paths will be appended to it. */
     #define LV_FS_POSIX_CACHE_SIZE 0    /**< >0 to cache this number of bytes in lv_fs_read() */
+    #define LV_FS_POSIX_MMAP 0          /**< 1: Let lv_fs_map() map the files so that uncompressed images are used without copying them */
 #endif
 
 /** API for CreateFile, ReadFile, etc. */
@@ -942,6 +1037,11 @@
 
 /** Decode bin images to RAM */
 #define LV_BIN_DECODER_RAM_LOAD 1
+#if LV_BIN_DECODER_RAM_LOAD == 0
+    /** Rows of RLE or LZ4 compressed images decompressed at once while they are drawn.
+     *  Two such bands of an image are kept in RAM instead of the whole image. */
+    #define LV_BIN_DECODER_BAND_HEIGHT 16
+#endif
 
 /** RLE decompress library */
 #define LV_USE_RLE 1
@@ -996,6 +1096,13 @@
 #define LV_USE_SVG 0
 #define LV_USE_SVG_ANIMATION 0
 #define LV_USE_SVG_DEBUG 0
+#if LV_USE_SVG
+    /** Size of the rasterized bitmaps kept per SVG source [bytes].
+     *  If an SVG is drawn again with the same size and transformation, its bitmap is blended
+     *  instead of rendering the vector paths again. The bitmaps are freed together with the
+     *  SVG in the image cache. Can be changed with `lv_svg_decoder_set_bitmap_cache_size()`. 0: disable */
+    #define LV_SVG_BITMAP_CACHE_SIZE 0
+#endif
 
 /** FFmpeg library for image decoding and playing videos.
  *  Supports all major image formats so do not enable other image decoder with it. */